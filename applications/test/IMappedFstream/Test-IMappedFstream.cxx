@@ -0,0 +1,200 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Application
+    Test-IMappedFstream
+
+Description
+    Read round-trip through a memory-mapped file, in ascii and binary,
+    compared with reading through IFstream.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "Fstream.H"
+#include "IMappedFstream.H"
+#include "OSspecific.H"
+#include "Random.H"
+#include "scalarField.H"
+#include "vectorField.H"
+
+using namespace Foam;
+
+// Contents read back from a stream
+struct contents
+{
+    word name;
+    labelList labels;
+    scalarField scalars;
+    vectorField vectors;
+
+    void read(Istream& is)
+    {
+        is >> name >> labels >> scalars >> vectors;
+    }
+
+    bool operator==(const contents& b) const
+    {
+        return
+        (
+            name == b.name
+         && labels == b.labels
+         && scalars == b.scalars
+         && vectors == b.vectors
+        );
+    }
+};
+
+
+label test(const fileName& fName, const contents& orig, IOstreamOption opt)
+{
+    {
+        OFstream os(fName, opt);
+        os  << orig.name << nl
+            << orig.labels << nl
+            << orig.scalars << nl
+            << orig.vectors << nl;
+    }
+
+    contents viaFile;
+    {
+        IFstream is(fName, opt);
+        viaFile.read(is);
+    }
+
+    contents viaMap;
+    IMappedFstream is(fName, opt);
+    viaMap.read(is);
+
+    Info<< "    " << IOstreamOption::formatNames[opt.format()]
+        << " " << is.fileSize() << " bytes";
+
+    // Ascii write/read is not exact for scalars, compare with IFstream
+    if (!is.good() || !(viaMap == viaFile) || viaMap.labels != orig.labels)
+    {
+        Info<< "  FAILED" << nl;
+        return 1;
+    }
+
+    if (opt.format() == IOstreamOption::BINARY && !(viaMap == orig))
+    {
+        Info<< "  FAILED (binary not exact)" << nl;
+        return 1;
+    }
+
+    Info<< "  ok" << nl;
+    return 0;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char *argv[])
+{
+    argList::noParallel();
+    argList::addOption("size", "label", "Number of values (default 100000)");
+
+    #include "setRootCase.H"
+
+    const label n = args.getOrDefault<label>("size", 100000);
+
+    Random rnd(1234);
+
+    contents orig;
+    orig.name = "mapped";
+    orig.labels = identity(n);
+    orig.scalars.resize(n);
+    orig.vectors.resize(n);
+    for (label i = 0; i < n; ++i)
+    {
+        orig.scalars[i] = rnd.sample01<scalar>();
+        orig.vectors[i] = rnd.sample01<vector>();
+    }
+
+    const fileName fName(cwd()/"Test-IMappedFstream.dat");
+
+    label nFailed = 0;
+
+    Info<< "Round-trip of " << n << " values" << nl;
+    nFailed += test(fName, orig, IOstreamOption(IOstreamOption::ASCII));
+    nFailed += test(fName, orig, IOstreamOption(IOstreamOption::BINARY));
+
+    // Selection: mapped only above the size threshold
+    {
+        const float oldSize = IMappedFstream::minFileSize;
+
+        IMappedFstream::minFileSize = 1;
+        autoPtr<ISstream> isPtr = IMappedFstream::New(fName);
+        if (!isA<IMappedFstream>(*isPtr))
+        {
+            Info<< "    New() did not select the mapped stream  FAILED" << nl;
+            ++nFailed;
+        }
+
+        IMappedFstream::minFileSize = 0;
+        isPtr = IMappedFstream::New(fName);
+        if (isA<IMappedFstream>(*isPtr))
+        {
+            Info<< "    New() selected the mapped stream  FAILED" << nl;
+            ++nFailed;
+        }
+
+        IMappedFstream::minFileSize = oldSize;
+    }
+
+    // Empty and missing files
+    {
+        OFstream(fName).flush();
+        IMappedFstream is(fName);
+        token tok;
+        is.read(tok);
+        if (!is.good() && !is.eof())
+        {
+            Info<< "    empty file  FAILED" << nl;
+            ++nFailed;
+        }
+    }
+
+    rm(fName);
+    if (IMappedFstream(fName).good())
+    {
+        Info<< "    missing file  FAILED" << nl;
+        ++nFailed;
+    }
+
+    if (nFailed)
+    {
+        Info<< nl << nFailed << " tests FAILED" << nl << endl;
+        return 1;
+    }
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
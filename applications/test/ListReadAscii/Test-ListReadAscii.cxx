@@ -0,0 +1,179 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-ListReadAscii
+
+Description
+    Reading of ASCII lists of numbers directly from the characters,
+    compared to (and timed against) reading via the tokenizer.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "clockTime.H"
+#include "IOstreams.H"
+#include "ITstream.H"
+#include "StringStream.H"
+#include "Random.H"
+#include "labelList.H"
+#include "scalarList.H"
+#include "vectorList.H"
+#include "symmTensor.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+template<class T>
+bool testTiming(const word& name, const List<T>& input)
+{
+    OStringStream os;
+    os.precision(std::numeric_limits<scalar>::max_digits10);
+    os << input;
+
+    clockTime timer;
+
+    // Direct
+    List<T> list1;
+    {
+        IStringStream is(os.str());
+        is >> list1;
+    }
+
+    const double directTime = timer.timeIncrement();
+
+    // Tokenized
+    List<T> list2;
+    {
+        ITstream is(os.str());
+        is >> list2;
+    }
+
+    const double tokenTime = timer.timeIncrement();
+
+    const bool ok = (list1 == input && list2 == input);
+
+    Info<< name << " (" << input.size() << ") direct: " << directTime
+        << " s  tokenized: " << tokenTime << " s"
+        << (ok ? "" : "  (MISMATCH)") << nl;
+
+    return ok;
+}
+
+
+template<class T>
+bool testParse(const string& str, const List<T>& expected)
+{
+    List<T> list;
+    {
+        IStringStream is(str);
+        is >> list;
+    }
+
+    const bool ok = (list == expected);
+
+    Info<< str << " => " << flatOutput(list)
+        << (ok ? "" : "  (MISMATCH)") << nl;
+
+    return ok;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::noBanner();
+    argList::noParallel();
+    argList::addOption("size", "label", "Number of values (default 1000000)");
+
+    #include "setRootCase.H"
+
+    const label n = args.getOrDefault<label>("size", 1000000);
+
+    bool ok = true;
+
+    // Comments, variations of the format and a fallback to the tokenizer
+    ok = testParse(string("3(1 2 3)"), labelList({1, 2, 3})) && ok;
+    ok = testParse(string("3{7}"), labelList({7, 7, 7})) && ok;
+    ok = testParse
+    (
+        string("3 ( 1 /* one */ -2 // two\n 3 )"),
+        labelList({1, -2, 3})
+    ) && ok;
+    ok = testParse
+    (
+        string("3(1 2.5e-3 -.5)"),
+        scalarList({1, 2.5e-3, -0.5})
+    ) && ok;
+    ok = testParse
+    (
+        string("2((1 2 3)(4 /* y */ 5 6))"),
+        vectorList({vector(1, 2, 3), vector(4, 5, 6)})
+    ) && ok;
+
+    // Timing of large lists
+    Random rndGen(0);
+
+    labelList labels(n);
+    forAll(labels, i)
+    {
+        labels[i] = rndGen.position<label>(-labelMax/2, labelMax/2);
+    }
+
+    scalarList scalars(n);
+    forAll(scalars, i)
+    {
+        scalars[i] = 1e5*rndGen.sample01<scalar>() - 5e4;
+    }
+
+    List<vector> vectors(n);
+    forAll(vectors, i)
+    {
+        vectors[i] = rndGen.sample01<vector>();
+    }
+
+    List<symmTensor> tensors(n/4);
+    forAll(tensors, i)
+    {
+        tensors[i] = rndGen.sample01<symmTensor>();
+    }
+
+    Info<< nl;
+    ok = testTiming("label", labels) && ok;
+    ok = testTiming("scalar", scalars) && ok;
+    ok = testTiming("vector", vectors) && ok;
+    ok = testTiming("symmTensor", tensors) && ok;
+
+    Info<< nl << (ok ? "All ok" : "FAILED") << nl
+        << "\nEnd\n" << endl;
+
+    return (ok ? 0 : 1);
+}
+
+
+// ************************************************************************* //
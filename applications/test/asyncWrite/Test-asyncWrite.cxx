@@ -0,0 +1,196 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Application
+    Test-asyncWrite
+
+Description
+    Background (threaded) file writing: the waits must only return once
+    the queued contents are on disk, for plain and compressed files, and
+    for all files within a directory before it is removed.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "IOstreams.H"
+#include "IFstream.H"
+#include "OSspecific.H"
+#include "OFstreamAsyncWriter.H"
+
+using namespace Foam;
+
+// Contents of file i, large enough to keep the writer threads busy
+std::string contents(const label i, const label nLines)
+{
+    std::string str;
+    for (label line = 0; line < nLines; ++line)
+    {
+        str += "file " + std::to_string(i)
+            + " line " + std::to_string(line) + '\n';
+    }
+    return str;
+}
+
+
+// Read the file (or its compressed version) back and compare
+label check(const fileName& fName, const std::string& expected)
+{
+    IFstream is(fName);
+
+    std::string str;
+    if (is.good())
+    {
+        char c;
+        while (is.get(c))
+        {
+            str += c;
+        }
+    }
+
+    if (str != expected)
+    {
+        Info<< "    " << fName << "  FAILED (read " << str.size()
+            << " of " << expected.size() << " bytes)" << nl;
+        return 1;
+    }
+    return 0;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+
+int main(int argc, char *argv[])
+{
+    argList::noParallel();
+    argList::addOption("threads", "label", "Number of threads (default 2)");
+    argList::addOption("files", "label", "Number of files (default 16)");
+
+    #include "setRootCase.H"
+
+    const label nThreads = args.getOrDefault<label>("threads", 2);
+    const label nFiles = args.getOrDefault<label>("files", 16);
+    const label nLines = 20000;
+
+    const fileName root(cwd()/"asyncWrite");
+    rmDir(root, true);
+
+    label nFailed = 0;
+
+    OFstreamAsyncWriter writer(nThreads, 64*1024*1024, 2);
+
+    Info<< "Writing " << nFiles << " files with "
+        << nThreads << " threads" << nl;
+
+    // Single file: waitFor
+    {
+        const fileName dir(root/"single");
+        mkDir(dir);
+
+        for (label i = 0; i < nFiles; ++i)
+        {
+            writer.write(dir/word::printf("f%d", i), contents(i, nLines));
+        }
+
+        for (label i = 0; i < nFiles; ++i)
+        {
+            const fileName fName(dir/word::printf("f%d", i));
+            writer.waitFor(fName);
+            nFailed += check(fName, contents(i, nLines));
+        }
+        Info<< "    waitFor(file)" << nl;
+    }
+
+    // Compressed file: waitFor with the compression extension
+    {
+        const fileName dir(root/"compressed");
+        mkDir(dir);
+
+        for (label i = 0; i < nFiles; ++i)
+        {
+            writer.write
+            (
+                dir/word::printf("f%d", i),
+                contents(i, nLines),
+                IOstreamOption::COMPRESSED
+            );
+        }
+
+        for (label i = 0; i < nFiles; ++i)
+        {
+            const fileName fName(dir/word::printf("f%d", i));
+            writer.waitFor(fName + ".gz");
+            nFailed += check(fName, contents(i, nLines));
+        }
+        Info<< "    waitFor(file.gz)" << nl;
+    }
+
+    // Directory: waitForPath, then remove and check nothing reappears
+    {
+        const fileName dir(root/"dir");
+        fileNameList fNames(nFiles);
+
+        for (label i = 0; i < nFiles; ++i)
+        {
+            fNames[i] = dir/word::printf("sub%d", i % 4)/word::printf("f%d", i);
+            mkDir(fNames[i].path());
+            writer.write(fNames[i], contents(i, nLines));
+        }
+
+        // Sibling with a common prefix must not be waited for
+        writer.waitForPath(root/"di");
+
+        writer.waitForPath(dir);
+        forAll(fNames, i)
+        {
+            nFailed += check(fNames[i], contents(i, nLines));
+        }
+
+        rmDir(dir);
+        writer.waitAll();
+
+        if (isDir(dir))
+        {
+            Info<< "    " << dir << "  FAILED (recreated)" << nl;
+            ++nFailed;
+        }
+        Info<< "    waitForPath(dir)" << nl;
+    }
+
+    rmDir(root, true);
+
+    if (nFailed)
+    {
+        Info<< nl << nFailed << " files FAILED" << nl << endl;
+        return 1;
+    }
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
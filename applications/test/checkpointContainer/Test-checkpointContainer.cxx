@@ -0,0 +1,157 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-checkpointContainer
+
+Description
+    Round-trip of objects through a checkpointContainer, compared with
+    writing and reading the individual (binary) files. The values must be
+    restored bit-identically.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "Time.H"
+#include "clockTime.H"
+#include "IOField.H"
+#include "IOdictionary.H"
+#include "OSspecific.H"
+#include "Random.H"
+#include "vectorField.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::noParallel();
+    argList::addOption("size", "label", "Number of values (default 1000000)");
+
+    #include "setRootCase.H"
+    #include "createTime.H"
+
+    const label n = args.getOrDefault<label>("size", 1000000);
+
+    IOField<vector> U
+    (
+        IOobject
+        (
+            "U",
+            runTime.timeName(),
+            "Test-checkpointContainer",
+            runTime,
+            IOobject::NO_READ,
+            IOobject::NO_WRITE,
+            IOobject::NO_REGISTER
+        ),
+        n
+    );
+
+    Random rndGen(0);
+    for (vector& v : U)
+    {
+        v = rndGen.sample01<vector>();
+    }
+
+    IOdictionary dict
+    (
+        IOobject
+        (
+            "properties",
+            runTime.timeName(),
+            "Test-checkpointContainer",
+            runTime,
+            IOobject::NO_READ,
+            IOobject::NO_WRITE,
+            IOobject::NO_REGISTER
+        )
+    );
+    dict.add("third", scalar(1)/3);
+
+    const fileName dir(runTime.timePath()/"Test-checkpointContainer");
+    const fileName file(dir/checkpointContainer::containerName);
+
+    clockTime timer;
+
+    // Individual files
+    U.writeObject(IOstreamOption(IOstreamOption::BINARY), true);
+    dict.writeObject(IOstreamOption(IOstreamOption::BINARY), true);
+
+    const double writeFiles = timer.timeIncrement();
+
+    {
+        IOobject io(U);
+        io.readOpt(IOobject::MUST_READ);
+        IOField<vector> U2(io);
+    }
+
+    const double readFiles = timer.timeIncrement();
+
+    // Container
+    {
+        checkpointContainer ckpt(runTime.timeName());
+        ckpt.add(U);
+        ckpt.add(dict);
+        ckpt.write(file);
+    }
+
+    const double writeContainer = timer.timeIncrement();
+
+    checkpointContainer ckpt(runTime.timeName(), file);
+    const label nObjects = ckpt.size();
+
+    IOobject io(U);
+    io.readOpt(IOobject::MUST_READ);
+    vectorField U2(*ckpt.readStream(io));
+
+    const double readContainer = timer.timeIncrement();
+
+    IOobject dictIO(dict);
+    dictIO.readOpt(IOobject::MUST_READ);
+    const dictionary dict2(*ckpt.readStream(dictIO));
+    const bool sameThird = (dict2.get<scalar>("third") == scalar(1)/3);
+
+    // Objects are released once read
+    Info<< "Objects in container: " << nObjects
+        << " (after reading: " << ckpt.size() << ")" << nl
+        << "files     write: " << writeFiles << " s  read: "
+        << readFiles << " s" << nl
+        << "container write: " << writeContainer << " s  read: "
+        << readContainer << " s" << nl
+        << "U     : " << (U2 == U ? "identical" : "MISMATCH") << nl
+        << "third : " << (sameThird ? "identical" : "MISMATCH") << nl;
+
+    Foam::rmDir(dir);
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,155 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-collatedWrite
+
+Description
+    Benchmark of the collated write: gathering the processor blocks onto
+    the master, versus collective MPI-IO (collatedMpiIO switch).
+    Checks that both give identical files.
+
+    Run in parallel, eg,
+        mpirun -np 4 Test-collatedWrite -parallel -size 1000000
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "clockTime.H"
+#include "Fstream.H"
+#include "OFstreamCollator.H"
+#include "OSspecific.H"
+#include "OStringStream.H"
+#include "Random.H"
+#include "vectorField.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+// Collated write of the data. Return the (max) elapsed time
+double write(const fileName& path, const string& data, const int mpiIO)
+{
+    OFstreamCollator::mpiIO = mpiIO;
+
+    // Without thread
+    OFstreamCollator writer(0);
+
+    UPstream::barrier(UPstream::worldComm);
+    clockTime timer;
+
+    writer.write
+    (
+        "vectorField",
+        path,
+        data,
+        IOstreamOption(IOstreamOption::BINARY),
+        IOstreamOption::NON_ATOMIC,
+        IOstreamOption::NON_APPEND,
+        false
+    );
+
+    UPstream::barrier(UPstream::worldComm);
+
+    return returnReduce(timer.elapsedTime(), maxOp<double>());
+}
+
+
+// File contents
+std::string slurp(const fileName& path)
+{
+    std::string buf(Foam::fileSize(path), '\0');
+
+    IFstream is(path);
+    is.stdStream().read(&buf[0], buf.size());
+
+    return buf;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::noBanner();
+    argList::addOption
+    (
+        "size",
+        "label",
+        "Number of values per processor (default 1000000)"
+    );
+
+    #include "setRootCase.H"
+
+    if (!UPstream::parRun())
+    {
+        Info<< "Requires a parallel run" << nl << endl;
+        return 0;
+    }
+
+    const label n = args.getOrDefault<label>("size", 1000000);
+
+    // Unequal sizes per processor
+    Random rndGen(UPstream::myProcNo());
+    vectorField fld(n + UPstream::myProcNo());
+    for (vector& v : fld)
+    {
+        v = rndGen.sample01<vector>();
+    }
+
+    OStringStream os(IOstreamOption::BINARY);
+    os << fld;
+    const string data(os.str());
+
+    const fileName baseDir("Test-collatedWrite-directory");
+    const fileName gathered(baseDir/"gathered");
+    const fileName collective(baseDir/"mpiIO");
+
+    Info<< "Writing " << returnReduce(label(data.size()), sumOp<label>())
+        << " bytes from " << UPstream::nProcs() << " processors" << nl;
+
+    const double gatherTime = write(gathered, data, 0);
+    const double mpiIOTime = write(collective, data, 1);
+
+    Info<< "  gathered : " << gatherTime << " s" << nl
+        << "  mpiIO    : " << mpiIOTime << " s" << nl;
+
+    if (UPstream::master())
+    {
+        Info<< "Files "
+            << (slurp(gathered) == slurp(collective) ? "identical" : "DIFFER")
+            << nl;
+
+        Foam::rmDir(baseDir);
+    }
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,264 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-compressedIO
+
+Description
+    Benchmark of the output compressions (gzip, zstd, lz4): write time,
+    read time and file size of representative fields, in ascii and binary.
+
+    Compressions without library support are skipped.
+
+    Also checks that truncated and corrupt zstd, lz4 files are read
+    errors, not silently short fields.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "clockTime.H"
+#include "Fstream.H"
+#include "fstreamPointer.H"
+#include "IOstreams.H"
+#include "IOmanip.H"
+#include "labelField.H"
+#include "mathematicalConstants.H"
+#include "OSspecific.H"
+#include "Random.H"
+#include "scalarField.H"
+#include "vectorField.H"
+
+#include <fstream>
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+template<class Type>
+void benchmark
+(
+    const fileName& baseDir,
+    const word& name,
+    const Field<Type>& fld
+)
+{
+    for
+    (
+        const auto fmt
+      : { IOstreamOption::ASCII, IOstreamOption::BINARY }
+    )
+    {
+        for
+        (
+            const auto comp
+          : {
+                IOstreamOption::UNCOMPRESSED,
+                IOstreamOption::COMPRESSED,
+                IOstreamOption::ZSTD,
+                IOstreamOption::LZ4
+            }
+        )
+        {
+            if (!ofstreamPointer::supports(comp))
+            {
+                continue;
+            }
+
+            const fileName path(baseDir/name);
+
+            clockTime timer;
+
+            {
+                OFstream os(path, IOstreamOption(fmt, comp));
+                os << fld;
+            }
+
+            const double writeTime = timer.timeIncrement();
+
+            Field<Type> fld2;
+            {
+                IFstream is(path, IOstreamOption(fmt));
+                is >> fld2;
+            }
+
+            const double readTime = timer.timeIncrement();
+
+            const off_t size =
+                Foam::fileSize(path + IOstreamOption::compressionExt(comp));
+
+            Info<< setw(8) << name
+                << setw(8) << IOstreamOption::formatNames[fmt]
+                << setw(8)
+                << (comp ? IOstreamOption::compressionExt(comp) + 1 : "none")
+                << "  write: " << writeTime << " s"
+                << "  read: " << readTime << " s"
+                << "  size: " << label(size)
+                << (fld2 == fld ? "" : "  (MISMATCH)") << nl;
+
+            Foam::rm(path);
+        }
+    }
+}
+
+
+// Damage the compressed file (truncate or overwrite its middle) and check
+// that reading it fails
+label checkDamaged
+(
+    const fileName& baseDir,
+    const scalarField& fld,
+    const IOstreamOption::compressionType comp,
+    const bool truncate
+)
+{
+    const fileName path(baseDir/"damaged");
+    const fileName compPath(path + IOstreamOption::compressionExt(comp));
+
+    {
+        OFstream os(path, IOstreamOption(IOstreamOption::BINARY, comp));
+        os << fld;
+    }
+
+    std::string contents;
+    {
+        std::ifstream is(compPath, std::ios_base::binary);
+        contents.assign(std::istreambuf_iterator<char>(is), {});
+    }
+
+    if (truncate)
+    {
+        contents.resize(contents.size()/2);
+    }
+    else
+    {
+        std::fill_n(&contents[contents.size()/2], 64, '\xA5');
+    }
+
+    {
+        std::ofstream os(compPath, std::ios_base::binary);
+        os << contents;
+    }
+
+    const bool oldThrowingIOError = FatalIOError.throwing(true);
+
+    bool failed = false;
+    try
+    {
+        IFstream is(path, IOstreamOption(IOstreamOption::BINARY));
+        scalarField fld2;
+        is >> fld2;
+
+        failed = !is.good() || fld2 != fld;
+    }
+    catch (const Foam::IOerror&)
+    {
+        failed = true;
+    }
+
+    FatalIOError.throwing(oldThrowingIOError);
+
+    Foam::rm(compPath);
+
+    Info<< setw(8) << (IOstreamOption::compressionExt(comp) + 1)
+        << (truncate ? "  truncated" : "  corrupt")
+        << (failed ? "  read error" : "  (NOT DETECTED)") << nl;
+
+    return !failed;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::noBanner();
+    argList::noParallel();
+    argList::addOption("size", "label", "Number of values (default 1000000)");
+
+    #include "setRootCase.H"
+
+    const label n = args.getOrDefault<label>("size", 1000000);
+
+    const fileName baseDir("Test-compressedIO-directory");
+    Foam::mkDir(baseDir);
+
+    // Smooth field (eg, pressure) with a large offset
+    scalarField p(n);
+    forAll(p, i)
+    {
+        p[i] = 1e5 + 100*Foam::sin(scalar(i)/n*constant::mathematical::twoPi);
+    }
+
+    // Velocity with small-scale noise
+    Random rndGen(0);
+    vectorField U(n);
+    forAll(U, i)
+    {
+        U[i] = vector(10, 0, 0) + 0.1*rndGen.sample01<vector>();
+    }
+
+    // Cell-to-cell connectivity like data
+    labelField owner(n);
+    forAll(owner, i)
+    {
+        owner[i] = i/3;
+    }
+
+    Info<< "Fields of " << n << " values" << nl << nl;
+
+    benchmark(baseDir, "p", p);
+    benchmark(baseDir, "U", U);
+    benchmark(baseDir, "owner", owner);
+
+    Info<< nl << "Damaged files" << nl;
+
+    label nUndetected = 0;
+
+    for (const auto comp : { IOstreamOption::ZSTD, IOstreamOption::LZ4 })
+    {
+        if (ofstreamPointer::supports(comp))
+        {
+            nUndetected += checkDamaged(baseDir, p, comp, true);
+            nUndetected += checkDamaged(baseDir, p, comp, false);
+        }
+    }
+
+    Foam::rmDir(baseDir);
+
+    if (nUndetected)
+    {
+        Info<< nl << nUndetected << " damaged files NOT DETECTED" << nl
+            << endl;
+        return 1;
+    }
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,204 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Application
+    Test-dictionaryLoad
+
+Description
+    Benchmark of reading a large reactions/thermo dictionary and of
+    repeated keyword lookups, with and without pattern (regex) entries.
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "clockTime.H"
+#include "dictionary.H"
+#include "Fstream.H"
+#include "IOstreams.H"
+#include "OSspecific.H"
+#include "StringStream.H"
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+word specieName(const label i)
+{
+    return word("S" + Foam::name(i));
+}
+
+
+// Write a synthetic mechanism with nSpecies thermo entries
+// and nReactions reaction entries
+void writeMechanism
+(
+    const fileName& file,
+    const label nSpecies,
+    const label nReactions
+)
+{
+    OFstream os(file);
+
+    os  << "species" << nl << nSpecies << nl << '(' << nl;
+    for (label i = 0; i < nSpecies; ++i)
+    {
+        os  << "    " << specieName(i) << nl;
+    }
+    os  << ')' << token::END_STATEMENT << nl << nl;
+
+    for (label i = 0; i < nSpecies; ++i)
+    {
+        os  << specieName(i) << nl
+            << "{" << nl
+            << "    specie { molWeight " << 1 + i % 100 << "; }" << nl
+            << "    thermodynamics" << nl
+            << "    {" << nl
+            << "        Tlow 200; Thigh 5000; Tcommon 1000;" << nl
+            << "        highCpCoeffs (3.5 0.0012 -4e-07 6e-11 -3.5e-15"
+            << " -1000 3.1);" << nl
+            << "        lowCpCoeffs (3.6 -0.0006 1.5e-06 -2e-10 -4e-13"
+            << " -1000 3.7);" << nl
+            << "    }" << nl
+            << "    transport { As 1.67e-06; Ts 170.7; }" << nl
+            << "    elements { C 1; H " << i % 5 << "; }" << nl
+            << "}" << nl;
+    }
+
+    os  << nl << "reactions" << nl << '{' << nl;
+    for (label i = 0; i < nReactions; ++i)
+    {
+        os  << "    un-named-reaction-" << i << nl
+            << "    {" << nl
+            << "        type reversibleArrhenius;" << nl
+            << "        reaction \"" << specieName(i % nSpecies) << " + "
+            << specieName((i + 1) % nSpecies) << " = "
+            << specieName((i + 2) % nSpecies) << "\";" << nl
+            << "        A " << 1e10 + i << ";" << nl
+            << "        beta 0;" << nl
+            << "        Ta " << 1000 + i % 1000 << ";" << nl
+            << "    }" << nl;
+    }
+    os  << '}' << nl;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::noBanner();
+    argList::noParallel();
+    argList::addOption
+    (
+        "species",
+        "label",
+        "Number of species (default 20000)"
+    );
+    argList::addOption
+    (
+        "reactions",
+        "label",
+        "Number of reactions (default 180000)"
+    );
+    argList::addOption
+    (
+        "lookups",
+        "label",
+        "Number of repeated lookups (default 1000000)"
+    );
+
+    #include "setRootCase.H"
+
+    const label nSpecies = args.getOrDefault<label>("species", 20000);
+    const label nReactions = args.getOrDefault<label>("reactions", 180000);
+    const label nLookups = args.getOrDefault<label>("lookups", 1000000);
+
+    const fileName file("Test-dictionaryLoad-mechanism");
+
+    clockTime timer;
+
+    writeMechanism(file, nSpecies, nReactions);
+
+    Info<< "Wrote " << nSpecies << " species and " << nReactions
+        << " reactions in " << timer.timeIncrement() << " s" << nl;
+
+    dictionary mechanism;
+    {
+        IFstream is(file);
+        mechanism.read(is);
+    }
+
+    Info<< "Read in " << timer.timeIncrement() << " s" << nl;
+
+    // Literal lookups: every reaction
+    scalar sumA = 0;
+    const dictionary& reactions = mechanism.subDict("reactions");
+
+    for (const entry& e : reactions)
+    {
+        sumA += e.dict().get<scalar>("A");
+    }
+
+    Info<< "Lookup of " << reactions.size() << " reactions in "
+        << timer.timeIncrement() << " s (sum A: " << sumA << ')' << nl;
+
+    // Repeated lookups with patterns, as in fvSolution, fvSchemes or
+    // boundary condition coefficients read every time step
+    dictionary patterns
+    (
+        IStringStream
+        (
+            "\"(U|k|epsilon|omega|nuTilda)\" { tolerance 1e-6; }"
+            "\"(p|p_rgh)Final\" { tolerance 1e-8; }"
+            "\"Yi.*\" { tolerance 1e-9; }"
+            "\"(h|e)\" { tolerance 1e-7; }"
+            "T { tolerance 1e-7; }"
+        )()
+    );
+
+    const wordList names({"U", "pFinal", "YiCH4", "h", "T", "missing"});
+
+    label nFound = 0;
+    for (label i = 0; i < nLookups; ++i)
+    {
+        if (patterns.findDict(names[i % names.size()], keyType::REGEX))
+        {
+            ++nFound;
+        }
+    }
+
+    Info<< nLookups << " pattern lookups (" << nFound << " found) in "
+        << timer.timeIncrement() << " s" << nl;
+
+    Foam::rm(file);
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,306 @@
+/*---------------------------------------------------------------------------*\
+  =========                 |
+  \\      /  F ield         | OpenFOAM: The Open Source CFD Toolbox
+   \\    /   O peration     |
+    \\  /    A nd           | www.openfoam.com
+     \\/     M anipulation  |
+-------------------------------------------------------------------------------
+    Copyright (C) 2023 OpenCFD Ltd.
+-------------------------------------------------------------------------------
+License
+    This file is part of OpenFOAM.
+
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+
+Application
+    Test-wireFormat
+
+Description
+    Round-trip of the wireFormat encodings: the byte-plane encoding must be
+    bit-exact, the float encoding within single precision of the offset.
+
+    Tests the codec directly and through PstreamBuffers (to itself and, in
+    parallel, to the next processor).
+
+\*---------------------------------------------------------------------------*/
+
+#include "argList.H"
+#include "IOstreams.H"
+#include "mathematicalConstants.H"
+#include "PstreamBuffers.H"
+#include "Random.H"
+#include "scalarField.H"
+#include "vectorField.H"
+#include "wireFormat.H"
+
+#include <cstring>
+
+using namespace Foam;
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+// Compare values after a round-trip. Bit-exact for lossless formats.
+label nMismatch
+(
+    const wireFormat::formatType fmt,
+    const UList<scalar>& orig,
+    const UList<scalar>& vals,
+    const label nCmpts
+)
+{
+    if (fmt != wireFormat::FLOAT)
+    {
+        return
+        (
+            std::memcmp(orig.cdata(), vals.cdata(), orig.size_bytes())
+          ? orig.size() : 0
+        );
+    }
+
+    // Float values are relative to the last value of the component,
+    // which is sent at full precision
+    const label nLast = orig.size() - nCmpts;
+
+    label nBad = 0;
+    forAll(orig, i)
+    {
+        const scalar offset = mag(orig[nLast + i % nCmpts]);
+
+        if (mag(orig[i] - vals[i]) > 1e-6*(mag(orig[i]) + offset))
+        {
+            ++nBad;
+        }
+    }
+    return nBad;
+}
+
+
+// Encode/decode directly with the codec
+label testCodec
+(
+    const word& name,
+    const wireFormat::formatType fmt,
+    const UList<scalar>& orig,
+    const label nCmpts
+)
+{
+    const label n = orig.size();
+
+    List<char> buf(wireFormat::maxSize<scalar>(fmt, n));
+
+    const std::streamsize nWrite =
+        wireFormat::encode(fmt, orig.cdata(), n, nCmpts, buf.data());
+
+    scalarList vals(n, Zero);
+
+    const std::streamsize nRead =
+        wireFormat::decode(fmt, buf.cdata(), n, nCmpts, vals.data());
+
+    const label nBad = nMismatch(fmt, orig, vals, nCmpts);
+
+    Info<< "    " << name << " "
+        << wireFormat::formatNames[fmt] << ": "
+        << n*sizeof(scalar) << " -> " << label(nWrite) << " bytes";
+
+    if (nWrite != nRead || nWrite > buf.size() || nBad)
+    {
+        Info<< "  FAILED (" << nBad << " values, read " << label(nRead)
+            << " bytes)" << nl;
+        return 1;
+    }
+
+    Info<< "  ok" << nl;
+    return 0;
+}
+
+
+// Round-trip through PstreamBuffers, to myself and to the next processor
+label testStream
+(
+    const word& name,
+    const wireFormat::formatType fmt,
+    const UList<scalar>& orig,
+    const label nCmpts
+)
+{
+    const label myProci = UPstream::myProcNo();
+    const label nProcs = UPstream::nProcs();
+
+    const label sendProci = (myProci + 1) % nProcs;
+    const label recvProci = (myProci + nProcs - 1) % nProcs;
+
+    PstreamBuffers pBufs;
+
+    {
+        UOPstream os(myProci, pBufs);
+        os.writeEncoded(fmt, orig.cdata(), orig.size(), nCmpts);
+    }
+    if (sendProci != myProci)
+    {
+        UOPstream os(sendProci, pBufs);
+        os.writeEncoded(fmt, orig.cdata(), orig.size(), nCmpts);
+    }
+
+    pBufs.finishedSends();
+
+    label nFailed = 0;
+
+    labelList recvProcs(1, myProci);
+    if (recvProci != myProci)
+    {
+        recvProcs.push_back(recvProci);
+    }
+
+    for (const label proci : recvProcs)
+    {
+        scalarList vals(orig.size(), Zero);
+
+        UIPstream is(proci, pBufs);
+        is.readEncoded(vals.data(), vals.size(), nCmpts);
+
+        // All processors send the same values
+        if (nMismatch(fmt, orig, vals, nCmpts))
+        {
+            Pout<< "    " << name << " "
+                << wireFormat::formatNames[fmt]
+                << ": stream from processor " << proci << " FAILED" << nl;
+            ++nFailed;
+        }
+    }
+
+    return nFailed;
+}
+
+
+// * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * //
+// Main program:
+
+int main(int argc, char *argv[])
+{
+    argList::noCheckProcessorDirectories();
+    argList::addOption("size", "label", "Number of values (default 10000)");
+
+    #include "setRootCase.H"
+
+    const label n = args.getOrDefault<label>("size", 10000);
+
+    // Test data, identical on all processors
+    HashTable<scalarField> scalars;
+    HashTable<vectorField> vectors;
+
+    {
+        scalarField& fld = scalars("smooth");
+        fld.resize(n);
+        forAll(fld, i)
+        {
+            fld[i] =
+                1e5
+              + 100*Foam::sin(scalar(i)/n*constant::mathematical::twoPi);
+        }
+    }
+    {
+        Random rndGen(0);
+        scalarField& fld = scalars("random");
+        fld.resize(n);
+        forAll(fld, i)
+        {
+            fld[i] = rndGen.GaussNormal<scalar>();
+        }
+    }
+    {
+        scalarField& fld = scalars("uniform");
+        fld.resize(n, 101325);
+    }
+    {
+        // Signed zeros, denormals and extremes
+        scalarField& fld = scalars("special");
+        fld.resize(n);
+        forAll(fld, i)
+        {
+            switch (i % 6)
+            {
+                case 0: fld[i] = 0; break;
+                case 1: fld[i] = -0.0; break;
+                case 2: fld[i] = 1e-310; break;
+                case 3: fld[i] = -VGREAT; break;
+                case 4: fld[i] = ROOTVSMALL; break;
+                default: fld[i] = scalar(i); break;
+            }
+        }
+    }
+    {
+        Random rndGen(1);
+        vectorField& fld = vectors("velocity");
+        fld.resize(n);
+        forAll(fld, i)
+        {
+            fld[i] = vector(10, 0, 0) + 0.1*rndGen.sample01<vector>();
+        }
+    }
+
+    label nFailed = 0;
+
+    for
+    (
+        const auto fmt
+      : { wireFormat::NATIVE, wireFormat::FLOAT, wireFormat::BYTE_PLANE }
+    )
+    {
+        Info<< nl << "Format: " << wireFormat::formatNames[fmt] << nl;
+
+        for (const word& name : scalars.sortedToc())
+        {
+            // Special values are outside float range
+            if (fmt == wireFormat::FLOAT && name == "special")
+            {
+                continue;
+            }
+
+            const scalarField& fld = scalars[name];
+
+            nFailed += testCodec(name, fmt, fld, 1);
+            nFailed += testStream(name, fmt, fld, 1);
+        }
+
+        for (const word& name : vectors.sortedToc())
+        {
+            const vectorField& fld = vectors[name];
+
+            const UList<scalar> cmpts
+            (
+                const_cast<scalar*>(fld.cdata()->cdata()),
+                3*fld.size()
+            );
+
+            nFailed += testCodec(name, fmt, cmpts, 3);
+            nFailed += testStream(name, fmt, cmpts, 3);
+        }
+    }
+
+    reduce(nFailed, sumOp<label>());
+
+    if (nFailed)
+    {
+        Info<< nl << nFailed << " round-trips FAILED" << nl << endl;
+        return 1;
+    }
+
+    Info<< "\nEnd\n" << endl;
+
+    return 0;
+}
+
+
+// ************************************************************************* //